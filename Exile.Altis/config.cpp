@@ -3372,6 +3372,17 @@ class CfgExileCustomCode
 
 		ExileClient_util_fusRoDah = "myaddon\myfunction.sqf";
 	*/
+
+	// Trade journal (scripts\trade_hooks.sqf)
+	ExileServer_system_trading_network_purchaseItemRequest = "scripts\overrides\ExileServer_system_trading_network_purchaseItemRequest.sqf";
+	ExileServer_system_trading_network_sellItemRequest = "scripts\overrides\ExileServer_system_trading_network_sellItemRequest.sqf";
+	ExileServer_system_trading_network_purchaseVehicleRequest = "scripts\overrides\ExileServer_system_trading_network_purchaseVehicleRequest.sqf";
+	ExileServer_system_trading_network_purchaseVehicleSkinRequest = "scripts\overrides\ExileServer_system_trading_network_purchaseVehicleSkinRequest.sqf";
+	ExileServer_system_trading_network_wasteDumpRequest = "scripts\overrides\ExileServer_system_trading_network_wasteDumpRequest.sqf";
+
+	// Locker ledger (scripts\locker_ledger.sqf)
+	ExileServer_system_locker_network_lockerDepositRequest = "scripts\overrides\ExileServer_system_locker_network_lockerDepositRequest.sqf";
+	ExileServer_system_locker_network_lockerWithdrawalRequest = "scripts\overrides\ExileServer_system_locker_network_lockerWithdrawalRequest.sqf";
 };
 class CfgExileEnvironment
 {